@@ -50,13 +50,14 @@
 // 'tool_launcher' is invoked by an 'exec' system call.  Its command
 // line is as follows:
 //
-//     <launcher> [-dbg fd] [-t] -err fd -root root [-env ev] -cmd argv
+//     <launcher> [-dbg fd] [-t] -err fd -root root [-dev rdev path]...
+//                [-env ev] -cmd argv
 //   where:
 //     -dbg fd     if present, specifies that debugging output is to be
 //                 written to the file descriptor 'fd'.
 //     -t          if present, specifies testing mode.  The 'chroot'
-//                 operation is not performed, although the "-root" argument
-//                 must still be present.
+//                 operation is not performed (nor are "-dev" devices made),
+//                 although the "-root" argument must still be present.
 //     -err fd     'fd' is the file descriptor to be used to report errors
 //                 during the launching process, including the final 'exec'
 //                 of the specified command.  See description of error
@@ -64,6 +65,14 @@
 //     -root dir   'dir' specifies the path to be used as the tool's root
 //                 directory.  This directory is the subject of the 'chroot'
 //                 system call.
+//     -dev rdev path
+//                 if present (any number of times), specifies that a
+//                 character device with the decimal device number 'rdev'
+//                 is to be made at 'path', relative to the root directory,
+//                 before the tool is run.  The RunToolServer can't make
+//                 devices in the local trees it runs tools in (see
+//                 LocalTree.H).  Only the devices named in
+//                 LAUNCHER_DEVICES, below, can be made.
 //     -env ev     if present, 'ev' is a sequence of environment variable
 //                 definitions.  That is, 'ev' is a sequence of arguments
 //                 each of which is a string in the form specified by the
@@ -127,11 +136,21 @@ enum launcher_failure {
 
   mount_tmpfs_failure = 14,
 
+  make_device_failure = 15,          // a "-dev" device couldn't be made,
+                                     // or isn't one of LAUNCHER_DEVICES
+
   launcher_failure_enum_end          // new kinds of launcher failure
                                      // should be defined before
                                      // launcher_failure_enum_end value  
   };
 
+// The devices that "-dev" can make: the character devices with these
+// names in the host's /dev, which any user can use anyway.  (An
+// initializer for an array of strings.)
+#define LAUNCHER_DEVICES \
+  { "/dev/null", "/dev/zero", "/dev/full", "/dev/random", "/dev/urandom", \
+    "/dev/tty", NULL }
+
 //  The comments on the elements of 'launcher_failure' indicate whether
 //  the error is likely to be an implementation problem in Vesta, or a
 //  configuration problem or client error.  In the latter case, the error
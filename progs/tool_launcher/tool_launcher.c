@@ -88,6 +88,8 @@ static bool verbose = false;            /* true => debugging output */
 static bool testing = false;            /* true => no chroot */
 
 static char *root = NULL;               /* directory for chroot */
+static char **devices = NULL;           /* "-dev rdev path" triples */
+static int ndevices = 0;                /* number of them */
 static char **command = NULL;           /* command line to be executed */
 static char **envvars = NULL;           /* environment variables */
 
@@ -117,7 +119,8 @@ char *messages[] = {
   "Working directory outside root",
   "Couldn't chdir to working directory after chroot",
   "Couldn't mount procfs on the /proc",
-  "Couldn't mount tmpfs on the /tmp"
+  "Couldn't mount tmpfs on the /tmp",
+  "Couldn't make device"
 };
 
 static void giveup(int code, int errn)
@@ -210,6 +213,15 @@ static void parse(int argc, char *argv[])
   root = next_arg();
   arg = next_arg();
 
+  /* -dev rdev path (optional, repeated) */
+  if (strcmp(arg, "-dev") == 0) devices = pcurrent_arg();
+  while (strcmp(arg, "-dev") == 0) {
+    (void) next_arg();
+    (void) next_arg();
+    ndevices++;
+    arg = next_arg();
+  }
+
   /* -env envvars (optional) */
   if (strcmp(arg, "-env") == 0) {
     envvars = pnext_arg();
@@ -266,6 +278,48 @@ void set_close_on_exec()
     }
 }
 
+/* The device numbers of LAUNCHER_DEVICES; must be found before chroot */
+#define MAX_ALLOWED_DEVICES 16
+static dev_t allowed_devices[MAX_ALLOWED_DEVICES];
+static int nallowed_devices = 0;
+
+void find_allowed_devices()
+{
+  static const char *names[] = LAUNCHER_DEVICES;
+  struct stat st;
+  int i;
+  for (i = 0; (names[i] != NULL) && (i < MAX_ALLOWED_DEVICES); i++)
+    {
+      if ((stat(names[i], &st) == 0) && S_ISCHR(st.st_mode))
+	allowed_devices[nallowed_devices++] = st.st_rdev;
+    }
+}
+
+/* Make the "-dev" devices.  After chroot, so their paths are
+   interpreted in the tool's root. */
+void make_devices()
+{
+  int i, j;
+  dev_t rdev;
+  char *end;
+  mode_t old_mask;
+  for (i = 0; i < ndevices; i++)
+    {
+      errno = 0;
+      rdev = (dev_t) strtoul(devices[(3 * i) + 1], &end, 10);
+      if ((errno != 0) || (*end != '\0'))
+	giveup(make_device_failure, errno);
+      for (j = 0; (j < nallowed_devices) && (allowed_devices[j] != rdev); j++)
+	/*SKIP*/;
+      if (j == nallowed_devices)
+	giveup(make_device_failure, 0);
+      old_mask = umask(0);
+      if (mknod(devices[(3 * i) + 2], S_IFCHR | 0666, rdev) == SYSERROR)
+	giveup(make_device_failure, errno);
+      (void) umask(old_mask);
+    }
+}
+
 int main(int argc, char *argv[])
 {
   char *cwd, cwd_buff[1024];
@@ -293,6 +347,8 @@ int main(int argc, char *argv[])
     giveup(wd_not_in_root, 0);
   }
 
+  find_allowed_devices();
+
   /* execute chroot(2) */
   if (!testing && chroot(root) == SYSERROR) {
     giveup(chroot_failure, errno);
@@ -326,6 +382,9 @@ int main(int argc, char *argv[])
   }
 
 
+  /* Devices are only made in the tool's root, so not when testing */
+  if (!testing) make_devices();
+
   /* Change effective user id back to real user id. */
   if (setuid(getuid()) == SYSERROR) {
     giveup(seteuid_failure, errno);